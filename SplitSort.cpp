@@ -17,6 +17,7 @@
 #include "Utils/Partition.h"
 #include "Utils/Record.h"
 #include "Utils/HelperFunctions.h"
+#include "Utils/Verifier.h"
 
 #define PRINT_SAMPLED_KEYS 0
 #define PRINT_SORTED_SAMPLED_KEYS 0
@@ -81,7 +82,7 @@ static unsigned long nodesPerAllocation;
 static unsigned long numKeysToSort;
 
 Record* mmapUnsortedFile();
-void splitSort(Record* recordsBaseAddr);
+size_t splitSort(Record* recordsBaseAddr);
 void systematicParSample(Record* recordsBaseAddr, vector<KeyPtrPair>* sampledKeys);
 void stdSortSamples(vector<KeyPtrPair>* sampledKeys);
 void parPartitionSamples(vector<KeyPtrPair>* sampledKeys, Partition *partitions);
@@ -130,7 +131,7 @@ int main(int argc, char *argv[]) {
 
     /* Set up the final array to store the sorted (Key, Record *) pairs*/
 
-    finalSortedPairs = new KeyPtrPair[numKeysToSort];
+    finalSortedPairs = new KeyPtrPair[numKeysToSort]();
 
 #if PRINT_UNSORTED_KEYS
     /* To be used for sanity checks only */
@@ -143,29 +144,34 @@ int main(int argc, char *argv[]) {
     /* To be used for sanity checks only */
     sort(recordBaseAddr, recordBaseAddr + numKeysToSort, [](Record x, Record y) {return x.key < y.key;});
 #endif
-    splitSort(recordBaseAddr); 
+    double sortStartTime = omp_get_wtime();
+    size_t numSortedPairs = splitSort(recordBaseAddr);
+    double sortTime = omp_get_wtime() - sortStartTime;
+    cout << "Sort time (s) = " << sortTime << "\n";
 
 #if CHECK_KEYS_ARE_SORTED
-    /* Verify that the sorting algorithm is CORRECT.  */
+    /* Verify that the sorting algorithm is CORRECT: keys are in ascending order, and no Record was lost or duplicated. */
     cout << "Working... Verifying keys are correctly sorted" << endl;
 
-    int errorRegister = 0;
+    double verifyStartTime = omp_get_wtime();
+    VerificationResult verification = verifySortedPairs(recordBaseAddr, numKeysToSort, finalSortedPairs, numSortedPairs, numThreads);
+    double verifyTime = omp_get_wtime() - verifyStartTime;
+    cout << "Verification time (s) = " << verifyTime << " (" << (100.0 * verifyTime / sortTime) << "% of sort time)\n";
 
-    #pragma omp parallel for num_threads(64) 
-    for (int i = 1; i < numKeysToSort; i++) {
-        if ((finalSortedPairs + i)->key < (finalSortedPairs + i - 1)->key || errorRegister != 0) {
-            cout << "!!! Critical Failure. Sorting is incorrect !!!\n";
-            errorRegister++;
-            exit(1);
-        }
+    if (!verification.isSorted()) {
+        cout << "!!! Critical Failure. Sorting is incorrect, " << verification.orderViolations << " adjacent keys are out of order !!!\n";
+    }
+
+    if (!verification.isPermutation()) {
+        cout << "!!! Critical Failure. Sorting is incorrect, sorted output is NOT a permutation of the input (" << numSortedPairs << " of " << numKeysToSort << " Records written) !!!\n";
     }
 
-    if (errorRegister > 0) {
-        cout << "!!! Critical Failure. Sorting is WRONG !!!\n";
+    if (!verification.isCorrect()) {
+        delete[] finalSortedPairs;
         exit(1);
     }
 
-    cout << "Working... Success, Keys are in sorted ascending order! ✓ \n";
+    cout << "Working... Success, Keys are in sorted ascending order and no Records were lost! ✓ \n";
 #endif
 
     /* Cleanup */
@@ -175,7 +181,8 @@ int main(int argc, char *argv[]) {
 
 }
 
-void splitSort(Record* recordsBaseAddr) {
+/* Returns the number of (Key, Record *) pairs written into finalSortedPairs. */
+size_t splitSort(Record* recordsBaseAddr) {
 
     // Sample records (samples are stored in DRAM)
     vector<KeyPtrPair>* sampledKeys = new vector<KeyPtrPair>();
@@ -213,6 +220,8 @@ void splitSort(Record* recordsBaseAddr) {
     delete sampledKeys;
     delete[] partitions;
 
+    return rollingSum;
+
 }
 
 /* Perform systematic sampling of the unsorted Records, put them into sampledKeys vector. (Parallel) */
@@ -34,4 +34,32 @@ T* allocateNVMRegion(size_t targetLength, const char* TARGET_FILE_PATH) {
     T* tBaseAddr = (T*) pmemBaseAddr;
 
     return tBaseAddr;
-}
\ No newline at end of file
+}
+
+template <typename T>
+T* mapExistingNVMRegion(const char* TARGET_FILE_PATH, size_t* numItems, size_t* mappedLen) {
+	char *pmemBaseAddr;
+    int isPmem;
+#if DEBUG_INFO
+    std::cout << "Working... Mapping existing NVM file: " << TARGET_FILE_PATH << "\n";
+#endif
+    /* map an existing pmem file in its entirety (length 0, no PMEM_FILE_CREATE) */
+    if ((pmemBaseAddr = (char *) pmem_map_file(TARGET_FILE_PATH, 0, 0, 0, mappedLen, &isPmem)) == NULL) {
+        perror("pmem_map_file failed to map existing NVM region");
+        exit(1);
+    }
+
+    if (!isPmem) {
+        std::cout << "!!! Warning, mapped PMEM File is NOT in the Optane !!!\n";
+    }
+
+    if (*mappedLen % sizeof(T) != 0) {
+        std::cout << "!!! Critical Failure. " << TARGET_FILE_PATH << " is " << *mappedLen << " bytes, not a multiple of " << sizeof(T) << " bytes !!!\n";
+        pmem_unmap(pmemBaseAddr, *mappedLen);
+        exit(1);
+    }
+
+    *numItems = *mappedLen / sizeof(T);
+
+    return (T*) pmemBaseAddr;
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <omp.h>
+
+#include "Record.h"
+#include "KeyPtrPair.h"
+
+/*
+
+    ===== NOTE ON VERIFYING SORTED OUTPUT =====
+
+    Checking that adjacent keys are in order is not enough: a run that drops or duplicates
+    Records can still produce perfectly ordered output. We therefore also check that the
+    output is a PERMUTATION of the input by comparing multiset hashes of both sides.
+
+    A multiset hash is the sum (mod 2^64) of a per-item hash, so it does not depend on the
+    order in which items are visited. This lets every thread hash its own contiguous chunk in
+    one streaming pass, and lets the compiler vectorize the per-item hash across items. Two
+    independent lanes are kept (~128 bits) together with the item count.
+
+*/
+
+struct MultisetHash {
+    uint64_t count = 0;
+    uint64_t laneA = 0;
+    uint64_t laneB = 0;
+
+    bool operator==(const MultisetHash& other) const {
+        return count == other.count && laneA == other.laneA && laneB == other.laneB;
+    }
+    bool operator!=(const MultisetHash& other) const { return !(*this == other); }
+};
+
+struct VerificationResult {
+    size_t orderViolations = 0; // Number of adjacent pairs (i - 1, i) where key[i] < key[i - 1]
+    MultisetHash inputHash;
+    MultisetHash outputHash;
+
+    bool isSorted() const { return orderViolations == 0; }
+    bool isPermutation() const { return inputHash == outputHash; }
+    bool isCorrect() const { return isSorted() && isPermutation(); }
+};
+
+static const uint64_t MULTISET_SEED_A = 0x9E3779B97F4A7C15ULL;
+static const uint64_t MULTISET_SEED_B = 0xC2B2AE3D27D4EB4FULL;
+
+/* Finalizer from MurmurHash3. Every input bit affects every output bit. */
+#pragma omp declare simd
+inline uint64_t mixHash64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB93FE1A85A53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/* Hash of four 64-bit words, for lane A. Words are chained so that swapping them changes the hash. */
+#pragma omp declare simd
+inline uint64_t hashWordsA(uint64_t w0, uint64_t w1, uint64_t w2, uint64_t w3) {
+    uint64_t h = mixHash64(w0 ^ MULTISET_SEED_A);
+    h = mixHash64(h ^ w1);
+    h = mixHash64(h ^ w2);
+    return mixHash64(h ^ w3);
+}
+
+/* Hash of four 64-bit words, for lane B. Independent of lane A so that both lanes rarely collide together. */
+#pragma omp declare simd
+inline uint64_t hashWordsB(uint64_t w0, uint64_t w1, uint64_t w2, uint64_t w3) {
+    return mixHash64(mixHash64(w0 + MULTISET_SEED_B) + w1 * 0x87C37B91114253D5ULL + w2 * 0x4CF5AD432745937FULL + w3 * 0x52DCE729DA3ED7EDULL);
+}
+
+/* Multiset hash of whole Records (key and payload). Optionally counts order violations in the same pass. (Parallel) */
+inline MultisetHash hashRecords(const Record* records, size_t numRecords, unsigned int numThreads, size_t* orderViolations = nullptr) {
+
+    MultisetHash result;
+    result.count = numRecords;
+
+    uint64_t laneA = 0;
+    uint64_t laneB = 0;
+    size_t violations = 0;
+
+    #pragma omp parallel for simd num_threads(numThreads) schedule(static) reduction(+:laneA, laneB, violations)
+    for (size_t i = 0; i < numRecords; i++) {
+        uint64_t payload[3];
+        memcpy(payload, (records + i)->value.val, sizeof(payload));
+        uint64_t key = (records + i)->key;
+        laneA += hashWordsA(key, payload[0], payload[1], payload[2]);
+        laneB += hashWordsB(key, payload[0], payload[1], payload[2]);
+        violations += (i > 0 && key < (records + i - 1)->key);
+    }
+
+    result.laneA = laneA;
+    result.laneB = laneB;
+    if (orderViolations != nullptr) *orderViolations = violations;
+    return result;
+}
+
+/*
+
+    SplitSort never moves Records; the sorted output is an array of (Key, Record *) pairs into
+    the unsorted file. The payload therefore travels with the pointer, and the output is a
+    permutation of the input iff the multiset of (key, record index) matches. Hashing indices
+    instead of dereferencing each pointer keeps both passes sequential.
+
+*/
+
+/* Multiset hash of (key, index) over the unsorted Records. (Parallel) */
+inline MultisetHash hashRecordKeyIndices(const Record* records, size_t numRecords, unsigned int numThreads) {
+
+    MultisetHash result;
+    result.count = numRecords;
+
+    uint64_t laneA = 0;
+    uint64_t laneB = 0;
+
+    #pragma omp parallel for simd num_threads(numThreads) schedule(static) reduction(+:laneA, laneB)
+    for (size_t i = 0; i < numRecords; i++) {
+        uint64_t key = (records + i)->key;
+        laneA += hashWordsA(key, i, 0, 0);
+        laneB += hashWordsB(key, i, 0, 0);
+    }
+
+    result.laneA = laneA;
+    result.laneB = laneB;
+    return result;
+}
+
+/* Multiset hash of (key, index of recordPtr relative to recordsBaseAddr) over the sorted pairs, counting order violations in the same pass. (Parallel) */
+inline MultisetHash hashKeyPtrPairs(const KeyPtrPair* pairs, size_t numPairs, const Record* recordsBaseAddr, unsigned int numThreads, size_t* orderViolations = nullptr) {
+
+    MultisetHash result;
+    result.count = numPairs;
+
+    uint64_t laneA = 0;
+    uint64_t laneB = 0;
+    size_t violations = 0;
+
+    #pragma omp parallel for simd num_threads(numThreads) schedule(static) reduction(+:laneA, laneB, violations)
+    for (size_t i = 0; i < numPairs; i++) {
+        uint64_t key = (pairs + i)->key;
+        uint64_t index = (uint64_t) ((pairs + i)->recordPtr - recordsBaseAddr);
+        laneA += hashWordsA(key, index, 0, 0);
+        laneB += hashWordsB(key, index, 0, 0);
+        violations += (i > 0 && key < (pairs + i - 1)->key);
+    }
+
+    result.laneA = laneA;
+    result.laneB = laneB;
+    if (orderViolations != nullptr) *orderViolations = violations;
+    return result;
+}
+
+/* Verify that sortedRecords is an ascending permutation of unsortedRecords. Reads each file once. (Parallel) */
+inline VerificationResult verifySortedRecords(const Record* unsortedRecords, size_t numUnsorted, const Record* sortedRecords, size_t numSorted, unsigned int numThreads) {
+    VerificationResult result;
+    result.inputHash = hashRecords(unsortedRecords, numUnsorted, numThreads);
+    result.outputHash = hashRecords(sortedRecords, numSorted, numThreads, &result.orderViolations);
+    return result;
+}
+
+/* Verify that sortedPairs is an ascending permutation of the (key, Record *) pairs of unsortedRecords. Reads each array once. (Parallel) */
+inline VerificationResult verifySortedPairs(const Record* unsortedRecords, size_t numUnsorted, const KeyPtrPair* sortedPairs, size_t numSorted, unsigned int numThreads) {
+    VerificationResult result;
+    result.inputHash = hashRecordKeyIndices(unsortedRecords, numUnsorted, numThreads);
+    result.outputHash = hashKeyPtrPairs(sortedPairs, numSorted, unsortedRecords, numThreads, &result.orderViolations);
+    return result;
+}
@@ -0,0 +1,81 @@
+#include <libpmem.h>
+#include <iostream>
+#include <thread>
+
+#include <omp.h>
+
+#include "Utils/Record.h"
+#include "Utils/HelperFunctions.h"
+#include "Utils/Verifier.h"
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+
+    /*
+
+    Usage: <num_threads> <unsorted_file_path> <sorted_file_path>
+
+    Checks that the sorted file is in ascending key order AND is a permutation of the unsorted file (same multiset of Records).
+    A <num_threads> of 0 uses the hardware concurrency. Exits with status 1 on bad usage or if verification fails.
+
+    */
+
+    if (argc != 4) {
+        cout << "Num args supplied = " << argc << endl;
+        cout << "Usage: <num_threads> <unsorted_file_path> <sorted_file_path>" << endl;
+        return 1;
+    }
+
+    int requestedThreads = atoi(argv[1]);
+    if (requestedThreads < 0) {
+        cout << "Invalid number of threads: " << argv[1] << endl;
+        return 1;
+    }
+
+    unsigned int numThreads = requestedThreads == 0 ? thread::hardware_concurrency() : requestedThreads;
+
+    const char* unsortedFilePath = argv[2];
+    const char* sortedFilePath = argv[3];
+
+    omp_set_dynamic(0); // Explicitly disable dynamic teams
+    omp_set_num_threads(numThreads);
+
+    cout << "Working... Mapping NVM files\n";
+
+    size_t numUnsorted, numSorted, unsortedMappedLen, sortedMappedLen;
+    Record* unsortedBaseAddr = mapExistingNVMRegion<Record>(unsortedFilePath, &numUnsorted, &unsortedMappedLen);
+    Record* sortedBaseAddr = mapExistingNVMRegion<Record>(sortedFilePath, &numSorted, &sortedMappedLen);
+
+    cout << "Number of Records (unsorted): " << numUnsorted << endl;
+    cout << "Number of Records (sorted): " << numSorted << endl;
+    cout << "Number of Threads used: " << numThreads << endl;
+
+    cout << "Working... Verifying sorted file is an ordered permutation of unsorted file" << endl;
+
+    double startTime = omp_get_wtime();
+    VerificationResult result = verifySortedRecords(unsortedBaseAddr, numUnsorted, sortedBaseAddr, numSorted, numThreads);
+    double elapsed = omp_get_wtime() - startTime;
+
+    cout << "Verification time (s) = " << elapsed << "\n";
+
+    pmem_unmap((char* ) unsortedBaseAddr, unsortedMappedLen);
+    pmem_unmap((char* ) sortedBaseAddr, sortedMappedLen);
+
+    if (!result.isSorted()) {
+        cout << "!!! Critical Failure. " << result.orderViolations << " adjacent Records are out of order !!!\n";
+    }
+
+    if (!result.isPermutation()) {
+        cout << "!!! Critical Failure. Sorted file is NOT a permutation of unsorted file (Records lost, duplicated or corrupted) !!!\n";
+    }
+
+    if (!result.isCorrect()) {
+        return 1;
+    }
+
+    cout << "Working... Success, Records are a sorted permutation of the input! ✓ \n";
+
+    return 0;
+
+}